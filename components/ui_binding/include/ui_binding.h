@@ -0,0 +1,165 @@
+/**
+ * @file ui_binding.h
+ * @brief Frame-coalesced data binding between producer tasks and LVGL widgets
+ *
+ * Producers publish values into typed observable slots from any task
+ * without taking the LVGL lock. Widgets subscribe to slots, and pending
+ * updates are applied from the LVGL task at most once per display refresh
+ * period.
+ *
+ * Features:
+ * - Lock-free publishing from any task (atomic value + version counter)
+ * - Updates coalesced to at most one per widget per refresh period
+ * - Change detection on both the value and the formatted text
+ * - Preallocated label text buffers (no heap allocation per update)
+ * - Bindings are released automatically when the widget is deleted
+ *
+ * @author ESP32-S3 LVGL Template Project
+ * @date 2025
+ */
+
+#ifndef UI_BINDING_H
+#define UI_BINDING_H
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Forward declaration for LVGL types (to avoid requiring LVGL header)
+typedef struct _lv_obj_t lv_obj_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Value type held by a slot
+ */
+typedef enum {
+    UI_BINDING_TYPE_INT,     /**< int32_t value */
+    UI_BINDING_TYPE_FLOAT,   /**< float value */
+} ui_binding_type_t;
+
+/**
+ * @brief Opaque observable slot
+ */
+typedef struct ui_binding_slot ui_binding_slot_t;
+
+/**
+ * @brief Binding statistics
+ */
+typedef struct {
+    uint32_t published;  /**< Values published into slots */
+    uint32_t passes;     /**< Update timer passes that found pending updates */
+    uint32_t applied;    /**< Widget updates applied */
+    uint32_t skipped;    /**< Updates dropped because value or text was unchanged */
+} ui_binding_stats_t;
+
+/**
+ * @brief Initialize the binding layer
+ *
+ * Creates an LVGL timer with period LV_DEF_REFR_PERIOD that applies pending
+ * slot updates. A published value is shown within about two refresh
+ * periods. The timer keeps the LVGL task waking once per refresh period
+ * even when the screen is idle. Must be called with the LVGL lock held.
+ *
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if the timer cannot be created
+ */
+esp_err_t ui_binding_init(void);
+
+/**
+ * @brief Create an observable slot
+ *
+ * Slots come from a static pool (CONFIG_UI_BINDING_MAX_SLOTS) and are never
+ * freed. The initial value is zero. Safe to call from any task.
+ *
+ * @param type Value type of the slot
+ * @return Pointer to the slot, or NULL if the pool is exhausted
+ */
+ui_binding_slot_t* ui_binding_slot_create(ui_binding_type_t type);
+
+/**
+ * @brief Publish an integer value into a slot
+ *
+ * Safe to call from any task; does not take the LVGL lock. A NULL slot is
+ * ignored.
+ *
+ * @param slot Slot created with UI_BINDING_TYPE_INT
+ * @param value New value
+ */
+void ui_binding_publish_int(ui_binding_slot_t *slot, int32_t value);
+
+/**
+ * @brief Publish a float value into a slot
+ *
+ * Safe to call from any task; does not take the LVGL lock. A NULL slot is
+ * ignored.
+ *
+ * @param slot Slot created with UI_BINDING_TYPE_FLOAT
+ * @param value New value
+ */
+void ui_binding_publish_float(ui_binding_slot_t *slot, float value);
+
+/**
+ * @brief Get the latest integer value of a slot
+ *
+ * @param slot Slot created with UI_BINDING_TYPE_INT
+ * @return Latest published value, or 0 if slot is NULL
+ */
+int32_t ui_binding_get_int(const ui_binding_slot_t *slot);
+
+/**
+ * @brief Get the latest float value of a slot
+ *
+ * @param slot Slot created with UI_BINDING_TYPE_FLOAT
+ * @return Latest published value, or 0.0f if slot is NULL
+ */
+float ui_binding_get_float(const ui_binding_slot_t *slot);
+
+/**
+ * @brief Bind a label's text to a slot
+ *
+ * The label text is formatted into a preallocated buffer and set with
+ * lv_label_set_text_static(). The format receives an `int` for integer
+ * slots and a `double` for float slots, and must outlive the binding
+ * (a string literal). The current value is applied immediately.
+ * Must be called with the LVGL lock held.
+ *
+ * @param label Label object
+ * @param slot Slot to observe
+ * @param fmt printf-style format with a single conversion, e.g. "%d" or "%.1f C"
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on bad arguments,
+ *         ESP_ERR_NO_MEM if the binding pool is exhausted
+ */
+esp_err_t ui_binding_bind_label(lv_obj_t *label, ui_binding_slot_t *slot, const char *fmt);
+
+/**
+ * @brief Bind a slider's value to a slot
+ *
+ * Float values are rounded to the nearest integer. The current value is
+ * applied immediately. Must be called with the LVGL lock held.
+ *
+ * @param slider Slider object
+ * @param slot Slot to observe
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG on bad arguments,
+ *         ESP_ERR_NO_MEM if the binding pool is exhausted
+ */
+esp_err_t ui_binding_bind_slider(lv_obj_t *slider, ui_binding_slot_t *slot);
+
+/**
+ * @brief Get binding statistics
+ *
+ * @param stats Output statistics
+ */
+void ui_binding_get_stats(ui_binding_stats_t *stats);
+
+/**
+ * @brief Reset binding statistics to zero
+ */
+void ui_binding_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_BINDING_H
@@ -0,0 +1,328 @@
+/**
+ * @file ui_binding.c
+ * @brief Frame-coalesced data binding implementation
+ *
+ * Slots hold the latest value as raw 32-bit atomics plus a version counter
+ * that producers bump on every publish. An LVGL timer running at the
+ * display refresh period compares each binding's last seen version against
+ * its slot and only touches widgets whose value actually changed.
+ *
+ * A timer is used rather than a display refresh event because LVGL pauses
+ * its refresh timer while nothing is invalidated; publishing does not
+ * invalidate anything, so a refresh event would never fire on a static
+ * screen. The timer also keeps the LVGL task from sleeping longer than one
+ * refresh period (instead of up to LVGL_TASK_MAX_DELAY_MS), so a published
+ * value reaches the screen within about two refresh periods.
+ */
+
+#include "ui_binding.h"
+#include <math.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "lvgl.h"
+
+static const char *TAG = "UI_BINDING";
+
+typedef enum {
+    BINDING_KIND_LABEL,
+    BINDING_KIND_SLIDER,
+} binding_kind_t;
+
+struct ui_binding_slot {
+    ui_binding_type_t type;
+    bool in_use;
+    atomic_uint value_bits;  // int32_t or float bit pattern
+    atomic_uint version;     // Incremented on every publish
+};
+
+typedef struct {
+    lv_obj_t *obj;           // NULL when the binding is free
+    ui_binding_slot_t *slot;
+    binding_kind_t kind;
+    const char *fmt;
+    uint32_t version;        // Last slot version seen
+    uint32_t value_bits;     // Last value applied to the widget
+    char text[CONFIG_UI_BINDING_TEXT_LEN];
+} binding_t;
+
+// Slot and binding pools
+static ui_binding_slot_t slots[CONFIG_UI_BINDING_MAX_SLOTS];
+static binding_t bindings[CONFIG_UI_BINDING_MAX_BINDINGS];
+static portMUX_TYPE slots_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Set by producers, cleared by the update timer
+static atomic_bool update_pending = false;
+
+// Statistics
+static atomic_uint stat_published;
+static atomic_uint stat_passes;
+static atomic_uint stat_applied;
+static atomic_uint stat_skipped;
+
+static lv_timer_t *update_timer = NULL;
+
+static inline uint32_t float_to_bits(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline float bits_to_float(uint32_t bits)
+{
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static void slot_publish(ui_binding_slot_t *slot, uint32_t bits)
+{
+    atomic_store_explicit(&slot->value_bits, bits, memory_order_relaxed);
+    atomic_fetch_add_explicit(&slot->version, 1, memory_order_release);
+    atomic_store_explicit(&update_pending, true, memory_order_release);
+    atomic_fetch_add_explicit(&stat_published, 1, memory_order_relaxed);
+}
+
+// Apply a value to the bound widget. Returns false if nothing changed.
+static bool binding_apply(binding_t *binding, uint32_t bits)
+{
+    bool is_float = (binding->slot->type == UI_BINDING_TYPE_FLOAT);
+
+    switch (binding->kind) {
+    case BINDING_KIND_LABEL: {
+        char text[CONFIG_UI_BINDING_TEXT_LEN];
+        if (is_float) {
+            snprintf(text, sizeof(text), binding->fmt, (double)bits_to_float(bits));
+        } else {
+            snprintf(text, sizeof(text), binding->fmt, (int)(int32_t)bits);
+        }
+
+        // Values that format identically (e.g. float noise below the
+        // printed precision) don't need a relayout
+        if (strcmp(text, binding->text) == 0) {
+            return false;
+        }
+        memcpy(binding->text, text, sizeof(binding->text));
+        lv_label_set_text_static(binding->obj, binding->text);
+        return true;
+    }
+    case BINDING_KIND_SLIDER: {
+        int32_t value = is_float ? (int32_t)lroundf(bits_to_float(bits)) : (int32_t)bits;
+        if (lv_slider_get_value(binding->obj) == value) {
+            return false;
+        }
+        lv_slider_set_value(binding->obj, value, LV_ANIM_OFF);
+        return true;
+    }
+    }
+
+    return false;
+}
+
+// Update timer: runs in the LVGL task once per refresh period
+static void binding_update_timer_cb(lv_timer_t *timer)
+{
+    (void)timer;
+
+    if (!atomic_exchange_explicit(&update_pending, false, memory_order_acquire)) {
+        return;
+    }
+    atomic_fetch_add_explicit(&stat_passes, 1, memory_order_relaxed);
+
+    for (int i = 0; i < CONFIG_UI_BINDING_MAX_BINDINGS; i++) {
+        binding_t *binding = &bindings[i];
+        if (binding->obj == NULL) {
+            continue;
+        }
+
+        uint32_t version = atomic_load_explicit(&binding->slot->version, memory_order_acquire);
+        if (version == binding->version) {
+            continue;
+        }
+        binding->version = version;
+
+        uint32_t bits = atomic_load_explicit(&binding->slot->value_bits, memory_order_relaxed);
+        if (bits == binding->value_bits) {
+            // Published again with the same value
+            atomic_fetch_add_explicit(&stat_skipped, 1, memory_order_relaxed);
+            continue;
+        }
+        binding->value_bits = bits;
+
+        if (binding_apply(binding, bits)) {
+            atomic_fetch_add_explicit(&stat_applied, 1, memory_order_relaxed);
+        } else {
+            atomic_fetch_add_explicit(&stat_skipped, 1, memory_order_relaxed);
+        }
+    }
+}
+
+// Release the binding when its widget is deleted
+static void binding_delete_cb(lv_event_t *e)
+{
+    binding_t *binding = (binding_t *)lv_event_get_user_data(e);
+    binding->obj = NULL;
+    binding->slot = NULL;
+}
+
+static esp_err_t binding_add(lv_obj_t *obj, ui_binding_slot_t *slot,
+                             binding_kind_t kind, const char *fmt)
+{
+    if (!update_timer) {
+        ESP_LOGE(TAG, "Binding layer not initialized. Call ui_binding_init() first");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    binding_t *binding = NULL;
+    for (int i = 0; i < CONFIG_UI_BINDING_MAX_BINDINGS; i++) {
+        if (bindings[i].obj == NULL) {
+            binding = &bindings[i];
+            break;
+        }
+    }
+    if (!binding) {
+        ESP_LOGE(TAG, "No free bindings (CONFIG_UI_BINDING_MAX_BINDINGS=%d)",
+                 CONFIG_UI_BINDING_MAX_BINDINGS);
+        return ESP_ERR_NO_MEM;
+    }
+
+    binding->obj = obj;
+    binding->slot = slot;
+    binding->kind = kind;
+    binding->fmt = fmt;
+    binding->text[0] = '\0';
+
+    // Apply the current value right away so the widget never shows stale data
+    binding->version = atomic_load_explicit(&slot->version, memory_order_acquire);
+    binding->value_bits = atomic_load_explicit(&slot->value_bits, memory_order_relaxed);
+    binding_apply(binding, binding->value_bits);
+
+    lv_obj_add_event_cb(obj, binding_delete_cb, LV_EVENT_DELETE, binding);
+    return ESP_OK;
+}
+
+esp_err_t ui_binding_init(void)
+{
+    if (update_timer) {
+        ESP_LOGW(TAG, "Binding layer already initialized");
+        return ESP_OK;
+    }
+
+    update_timer = lv_timer_create(binding_update_timer_cb, LV_DEF_REFR_PERIOD, NULL);
+    if (!update_timer) {
+        ESP_LOGE(TAG, "Failed to create update timer");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Binding layer initialized (%d slots, %d bindings, %d ms period)",
+             CONFIG_UI_BINDING_MAX_SLOTS, CONFIG_UI_BINDING_MAX_BINDINGS, LV_DEF_REFR_PERIOD);
+
+    return ESP_OK;
+}
+
+ui_binding_slot_t* ui_binding_slot_create(ui_binding_type_t type)
+{
+    ui_binding_slot_t *slot = NULL;
+
+    taskENTER_CRITICAL(&slots_lock);
+    for (int i = 0; i < CONFIG_UI_BINDING_MAX_SLOTS; i++) {
+        if (!slots[i].in_use) {
+            slot = &slots[i];
+            slot->in_use = true;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL(&slots_lock);
+
+    if (!slot) {
+        ESP_LOGE(TAG, "No free slots (CONFIG_UI_BINDING_MAX_SLOTS=%d)",
+                 CONFIG_UI_BINDING_MAX_SLOTS);
+        return NULL;
+    }
+
+    slot->type = type;
+    atomic_init(&slot->value_bits, type == UI_BINDING_TYPE_FLOAT ? float_to_bits(0.0f) : 0);
+    atomic_init(&slot->version, 0);
+
+    return slot;
+}
+
+void ui_binding_publish_int(ui_binding_slot_t *slot, int32_t value)
+{
+    if (!slot) {
+        return;
+    }
+
+    slot_publish(slot, (uint32_t)value);
+}
+
+void ui_binding_publish_float(ui_binding_slot_t *slot, float value)
+{
+    if (!slot) {
+        return;
+    }
+
+    slot_publish(slot, float_to_bits(value));
+}
+
+int32_t ui_binding_get_int(const ui_binding_slot_t *slot)
+{
+    if (!slot) {
+        return 0;
+    }
+
+    return (int32_t)atomic_load_explicit(&slot->value_bits, memory_order_relaxed);
+}
+
+float ui_binding_get_float(const ui_binding_slot_t *slot)
+{
+    if (!slot) {
+        return 0.0f;
+    }
+
+    return bits_to_float(atomic_load_explicit(&slot->value_bits, memory_order_relaxed));
+}
+
+esp_err_t ui_binding_bind_label(lv_obj_t *label, ui_binding_slot_t *slot, const char *fmt)
+{
+    if (!label || !slot || !fmt) {
+        ESP_LOGE(TAG, "Invalid label binding arguments");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    return binding_add(label, slot, BINDING_KIND_LABEL, fmt);
+}
+
+esp_err_t ui_binding_bind_slider(lv_obj_t *slider, ui_binding_slot_t *slot)
+{
+    if (!slider || !slot) {
+        ESP_LOGE(TAG, "Invalid slider binding arguments");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    return binding_add(slider, slot, BINDING_KIND_SLIDER, NULL);
+}
+
+void ui_binding_get_stats(ui_binding_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+
+    stats->published = atomic_load_explicit(&stat_published, memory_order_relaxed);
+    stats->passes = atomic_load_explicit(&stat_passes, memory_order_relaxed);
+    stats->applied = atomic_load_explicit(&stat_applied, memory_order_relaxed);
+    stats->skipped = atomic_load_explicit(&stat_skipped, memory_order_relaxed);
+}
+
+void ui_binding_reset_stats(void)
+{
+    atomic_store_explicit(&stat_published, 0, memory_order_relaxed);
+    atomic_store_explicit(&stat_passes, 0, memory_order_relaxed);
+    atomic_store_explicit(&stat_applied, 0, memory_order_relaxed);
+    atomic_store_explicit(&stat_skipped, 0, memory_order_relaxed);
+}
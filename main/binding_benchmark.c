@@ -0,0 +1,203 @@
+/**
+ * @file binding_benchmark.c
+ * @brief Data binding benchmark implementation
+ */
+
+#include "binding_benchmark.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_lvgl_port.h"
+#include "ui_binding.h"
+
+static const char *TAG = "BINDING_BENCH";
+
+#define BENCH_VALUE_COUNT   8
+#define BENCH_RATE_HZ       CONFIG_TEMPLATE_BINDING_BENCHMARK_RATE_HZ
+#define BENCH_DURATION_MS   (CONFIG_TEMPLATE_BINDING_BENCHMARK_SECONDS * 1000)
+#define BENCH_SETTLE_MS     (3 * LV_DEF_REFR_PERIOD)  // Time for the last publish to reach the screen
+
+typedef enum {
+    BENCH_MODE_DIRECT,   // lv_label_set_text_fmt() per update
+    BENCH_MODE_BOUND,    // ui_binding_publish_*() per update
+} bench_mode_t;
+
+static lv_obj_t *bench_labels[BENCH_VALUE_COUNT];
+static ui_binding_slot_t *bench_slots[BENCH_VALUE_COUNT];
+
+// Display invalidations and rendered frames (counted in the LVGL task)
+static atomic_uint invalidations;
+static atomic_uint frames_rendered;
+
+// Heap allocations from all tasks (counted by the ESP-IDF heap hooks)
+static atomic_uint heap_allocs;
+
+void IRAM_ATTR esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps)
+{
+    (void)ptr;
+    (void)size;
+    (void)caps;
+    atomic_fetch_add_explicit(&heap_allocs, 1, memory_order_relaxed);
+}
+
+void IRAM_ATTR esp_heap_trace_free_hook(void *ptr)
+{
+    (void)ptr;
+}
+
+static void invalidate_event_cb(lv_event_t *e)
+{
+    (void)e;
+    atomic_fetch_add_explicit(&invalidations, 1, memory_order_relaxed);
+}
+
+static void refr_ready_event_cb(lv_event_t *e)
+{
+    (void)e;
+    atomic_fetch_add_explicit(&frames_rendered, 1, memory_order_relaxed);
+}
+
+// Simulated sensor reading: each channel ramps at its own rate
+static int32_t bench_value(uint32_t step, int channel)
+{
+    return (int32_t)((step * (channel + 1)) % 1000);
+}
+
+// Count the labels that show the last value published in the phase
+static int bench_count_latest(uint32_t last_step)
+{
+    int matches = 0;
+    char expected[16];
+
+    lvgl_port_lock(0);
+    for (int i = 0; i < BENCH_VALUE_COUNT; i++) {
+        snprintf(expected, sizeof(expected), "%d", (int)bench_value(last_step, i));
+        if (strcmp(lv_label_get_text(bench_labels[i]), expected) == 0) {
+            matches++;
+        }
+    }
+    lvgl_port_unlock();
+
+    return matches;
+}
+
+static void bench_run_phase(bench_mode_t mode)
+{
+    const char *name = (mode == BENCH_MODE_DIRECT) ? "direct" : "bound ";
+    TickType_t period = configTICK_RATE_HZ / BENCH_RATE_HZ;
+    if (period == 0) {
+        period = 1;
+    }
+    uint32_t step = 0;
+    uint32_t direct_updates = 0;
+
+    atomic_store(&invalidations, 0);
+    atomic_store(&frames_rendered, 0);
+    atomic_store(&heap_allocs, 0);
+    ui_binding_reset_stats();
+
+    int64_t start_us = esp_timer_get_time();
+    TickType_t last_wake = xTaskGetTickCount();
+
+    while (esp_timer_get_time() - start_us < (int64_t)BENCH_DURATION_MS * 1000) {
+        if (mode == BENCH_MODE_DIRECT) {
+            lvgl_port_lock(0);
+            for (int i = 0; i < BENCH_VALUE_COUNT; i++) {
+                lv_label_set_text_fmt(bench_labels[i], "%d", (int)bench_value(step, i));
+                direct_updates++;
+            }
+            lvgl_port_unlock();
+        } else {
+            for (int i = 0; i < BENCH_VALUE_COUNT; i++) {
+                ui_binding_publish_int(bench_slots[i], bench_value(step, i));
+            }
+        }
+        step++;
+        vTaskDelayUntil(&last_wake, period);
+    }
+
+    // Snapshot the counters before letting the last publish settle
+    float seconds = (float)(esp_timer_get_time() - start_us) / 1000000.0f;
+    uint32_t invalidation_count = atomic_load(&invalidations);
+    uint32_t frame_count = atomic_load(&frames_rendered);
+    uint32_t alloc_count = atomic_load(&heap_allocs);
+    ui_binding_stats_t stats;
+    ui_binding_get_stats(&stats);
+    uint32_t updates = (mode == BENCH_MODE_DIRECT) ? direct_updates : stats.applied;
+
+    vTaskDelay(pdMS_TO_TICKS(BENCH_SETTLE_MS));
+    int latest = bench_count_latest(step - 1);
+
+    ESP_LOGI(TAG, "%s: %.0f Hz producer (%lu tick period), %.0f values/s",
+             name, step / seconds, (unsigned long)period, (step * BENCH_VALUE_COUNT) / seconds);
+    ESP_LOGI(TAG, "%s: %.0f label updates/s, %.0f invalidations/s, %.0f frames/s, %.0f heap allocs/s",
+             name, updates / seconds, invalidation_count / seconds,
+             frame_count / seconds, alloc_count / seconds);
+    ESP_LOGI(TAG, "%s: %d/%d labels show the latest value", name, latest, BENCH_VALUE_COUNT);
+    if (mode == BENCH_MODE_BOUND) {
+        ESP_LOGI(TAG, "%s: %lu applied in %lu update passes, %lu skipped as unchanged",
+                 name, (unsigned long)stats.applied, (unsigned long)stats.passes,
+                 (unsigned long)stats.skipped);
+    }
+    if (latest != BENCH_VALUE_COUNT) {
+        ESP_LOGW(TAG, "%s: labels did not reach the latest value", name);
+    }
+}
+
+void binding_benchmark_run(lv_display_t *disp)
+{
+    ESP_LOGI(TAG, "Running binding benchmark: %d labels at %d Hz requested, %d s per mode",
+             BENCH_VALUE_COUNT, BENCH_RATE_HZ, CONFIG_TEMPLATE_BINDING_BENCHMARK_SECONDS);
+
+    for (int i = 0; i < BENCH_VALUE_COUNT; i++) {
+        if (!bench_slots[i]) {
+            bench_slots[i] = ui_binding_slot_create(UI_BINDING_TYPE_INT);
+        }
+        if (!bench_slots[i]) {
+            ESP_LOGE(TAG, "Failed to create benchmark slots");
+            return;
+        }
+    }
+
+    lvgl_port_lock(0);
+    lv_obj_t *prev_scr = lv_display_get_screen_active(disp);
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x003a57), LV_PART_MAIN);
+    for (int i = 0; i < BENCH_VALUE_COUNT; i++) {
+        bench_labels[i] = lv_label_create(scr);
+        lv_label_set_text(bench_labels[i], "0");
+        lv_obj_set_style_text_color(bench_labels[i], lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+        lv_obj_align(bench_labels[i], LV_ALIGN_TOP_MID, 0, 20 + i * 30);
+    }
+    lv_screen_load(scr);
+    lv_display_add_event_cb(disp, invalidate_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    lv_display_add_event_cb(disp, refr_ready_event_cb, LV_EVENT_REFR_READY, NULL);
+    lvgl_port_unlock();
+
+    bench_run_phase(BENCH_MODE_DIRECT);
+
+    lvgl_port_lock(0);
+    for (int i = 0; i < BENCH_VALUE_COUNT; i++) {
+        ESP_ERROR_CHECK(ui_binding_bind_label(bench_labels[i], bench_slots[i], "%d"));
+    }
+    lvgl_port_unlock();
+
+    bench_run_phase(BENCH_MODE_BOUND);
+
+    // Deleting the screen also releases the label bindings
+    lvgl_port_lock(0);
+    lv_display_remove_event_cb_with_user_data(disp, invalidate_event_cb, NULL);
+    lv_display_remove_event_cb_with_user_data(disp, refr_ready_event_cb, NULL);
+    lv_screen_load(prev_scr);
+    lv_obj_delete(scr);
+    lvgl_port_unlock();
+
+    ESP_LOGI(TAG, "Binding benchmark complete");
+}
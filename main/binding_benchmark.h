@@ -0,0 +1,38 @@
+/**
+ * @file binding_benchmark.h
+ * @brief Data binding benchmark for ESP32-S3 LVGL Template
+ *
+ * Drives a screen of live value labels from a producer task at a high
+ * update rate, first with per-update lv_label_set_text_fmt() calls under
+ * the LVGL lock, then through the ui_binding component, and logs the
+ * resulting widget updates, invalidations, rendered frames and heap
+ * allocations per second for both modes. Each mode also checks that the
+ * labels end up showing the last published value.
+ *
+ * Enabled with CONFIG_TEMPLATE_BINDING_BENCHMARK.
+ */
+
+#ifndef BINDING_BENCHMARK_H
+#define BINDING_BENCHMARK_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Run the benchmark and restore the previous screen afterwards
+ *
+ * Blocks for about 2 * CONFIG_TEMPLATE_BINDING_BENCHMARK_SECONDS. Must be called
+ * without the LVGL lock held. ui_binding_init() must have been called.
+ *
+ * @param disp Display to run the benchmark on
+ */
+void binding_benchmark_run(lv_display_t *disp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BINDING_BENCHMARK_H
@@ -26,6 +26,13 @@
 #include "esp_lvgl_port.h"
 #include "lvgl.h"
 #include "ec11_encoder.h"
+#include "ui_binding.h"
+#if CONFIG_TEMPLATE_BINDING_BENCHMARK
+#include "binding_benchmark.h"
+#endif
+#if CONFIG_TEMPLATE_RENDER_SCENES_ENABLED
+#include "render_scenes.h"
+#endif
 
 #include "hardware_config.h"
 
@@ -38,6 +45,10 @@ static lv_display_t *lvgl_disp = NULL;
 static lv_indev_t *lvgl_encoder_indev = NULL;
 static lv_group_t *default_group = NULL;
 
+// Observable slots for the demo slider values
+static ui_binding_slot_t *slider1_value = NULL;
+static ui_binding_slot_t *slider2_value = NULL;
+
 // =============================================================================
 // LCD Initialization
 // =============================================================================
@@ -197,6 +208,11 @@ static esp_err_t lvgl_init(void)
     // Configure group to reduce navigation sensitivity
     lv_group_set_wrap(default_group, true);  // Allow wrapping around items
 
+    // Initialize data binding (widget updates applied once per refresh period)
+    lvgl_port_lock(0);
+    ESP_ERROR_CHECK(ui_binding_init());
+    lvgl_port_unlock();
+
     ESP_LOGI(TAG, "LVGL initialization complete");
     return ESP_OK;
 }
@@ -205,17 +221,27 @@ static esp_err_t lvgl_init(void)
 // Example LVGL UI - Simple Demo Screen
 // =============================================================================
 
-// Slider value changed callback
+// Slider value changed callback - publishes into the slider's slot,
+// the bound label is updated on the next refresh period
 static void slider_event_cb(lv_event_t *e)
 {
     lv_obj_t *slider = lv_event_get_target(e);
-    lv_obj_t *label = (lv_obj_t *)lv_event_get_user_data(e);
-    int32_t value = lv_slider_get_value(slider);
-    lv_label_set_text_fmt(label, "%d", (int)value);
+    ui_binding_slot_t *slot = (ui_binding_slot_t *)lv_event_get_user_data(e);
+    ui_binding_publish_int(slot, lv_slider_get_value(slider));
 }
 
 static void create_demo_ui(void)
 {
+    // Create slots for the slider values (any task may publish into them)
+    slider1_value = ui_binding_slot_create(UI_BINDING_TYPE_INT);
+    slider2_value = ui_binding_slot_create(UI_BINDING_TYPE_INT);
+    if (!slider1_value || !slider2_value) {
+        ESP_LOGE(TAG, "Failed to create slider value slots");
+        return;
+    }
+    ui_binding_publish_int(slider1_value, 50);
+    ui_binding_publish_int(slider2_value, 0);
+
     // Lock LVGL mutex before creating UI
     lvgl_port_lock(0);
 
@@ -254,12 +280,12 @@ static void create_demo_ui(void)
 
     // Value label for first slider
     lv_obj_t *value_label1 = lv_label_create(scr);
-    lv_label_set_text(value_label1, "50");
+    ESP_ERROR_CHECK(ui_binding_bind_label(value_label1, slider1_value, "%d"));
     lv_obj_set_style_text_color(value_label1, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
     lv_obj_align_to(value_label1, slider1, LV_ALIGN_OUT_TOP_MID, 0, -10);
 
-    // Add event to update label when first slider changes
-    lv_obj_add_event_cb(slider1, slider_event_cb, LV_EVENT_VALUE_CHANGED, value_label1);
+    // Publish first slider changes into its slot
+    lv_obj_add_event_cb(slider1, slider_event_cb, LV_EVENT_VALUE_CHANGED, slider1_value);
 
     // Create second slider with different range
     lv_obj_t *slider2 = lv_slider_create(scr);
@@ -273,12 +299,12 @@ static void create_demo_ui(void)
 
     // Value label for second slider  
     lv_obj_t *value_label2 = lv_label_create(scr);
-    lv_label_set_text(value_label2, "0");
+    ESP_ERROR_CHECK(ui_binding_bind_label(value_label2, slider2_value, "%d"));
     lv_obj_set_style_text_color(value_label2, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
     lv_obj_align_to(value_label2, slider2, LV_ALIGN_OUT_TOP_MID, 0, -10);
 
-    // Add event to update label when second slider changes
-    lv_obj_add_event_cb(slider2, slider_event_cb, LV_EVENT_VALUE_CHANGED, value_label2);
+    // Publish second slider changes into its slot
+    lv_obj_add_event_cb(slider2, slider_event_cb, LV_EVENT_VALUE_CHANGED, slider2_value);
 
     // Unlock LVGL mutex
     lvgl_port_unlock();
@@ -305,6 +331,14 @@ void app_main(void)
 
     ESP_LOGI(TAG, "Template ready! Modify create_demo_ui() to build your application.");
 
+#if CONFIG_TEMPLATE_RENDER_SCENES_ENABLED
+    render_scenes_run(lvgl_disp);
+#endif
+
+#if CONFIG_TEMPLATE_BINDING_BENCHMARK
+    binding_benchmark_run(lvgl_disp);
+#endif
+
     // Main loop - LVGL tasks run in background
     while (1) {
         // Your application code here
@@ -0,0 +1,197 @@
+/**
+ * @file render_scenes.c
+ * @brief Repeatable render scenes implementation
+ *
+ * Frame timing comes from display events: RENDER_START to RENDER_READY is
+ * the time to render and flush one frame, and FLUSH_WAIT_START to
+ * FLUSH_WAIT_FINISH is the part of it spent waiting for the SPI transfer.
+ * All timing state is only touched in the LVGL task or with the LVGL lock
+ * held.
+ */
+
+#include "render_scenes.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_lvgl_port.h"
+
+static const char *TAG = "RENDER_SCENES";
+
+#define SCENE_DURATION_MS   (CONFIG_TEMPLATE_RENDER_SCENE_SECONDS * 1000)
+#define SCENE_TIMER_MS      LV_DEF_REFR_PERIOD
+
+typedef enum {
+    SCENE_IDLE,          // Static screen, nothing invalidated
+    SCENE_SLIDER_SWEEP,  // Slider value stepped by a timer every refresh period
+    SCENE_FULL_REDRAW,   // Whole screen invalidated by a timer every refresh period
+} scene_t;
+
+typedef struct {
+    uint32_t frames;
+    int64_t render_us;       // RENDER_START to RENDER_READY, summed
+    int64_t flush_wait_us;   // FLUSH_WAIT_START to FLUSH_WAIT_FINISH, summed
+    int64_t max_frame_us;
+} scene_stats_t;
+
+static scene_stats_t stats;
+static int64_t render_start_us = 0;
+static int64_t flush_wait_start_us = 0;
+
+static lv_obj_t *scene_slider = NULL;
+
+static void render_event_cb(lv_event_t *e)
+{
+    int64_t now = esp_timer_get_time();
+
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_RENDER_START:
+        render_start_us = now;
+        break;
+    case LV_EVENT_RENDER_READY:
+        if (render_start_us) {
+            int64_t frame_us = now - render_start_us;
+            stats.frames++;
+            stats.render_us += frame_us;
+            if (frame_us > stats.max_frame_us) {
+                stats.max_frame_us = frame_us;
+            }
+            render_start_us = 0;
+        }
+        break;
+    case LV_EVENT_FLUSH_WAIT_START:
+        flush_wait_start_us = now;
+        break;
+    case LV_EVENT_FLUSH_WAIT_FINISH:
+        if (flush_wait_start_us) {
+            stats.flush_wait_us += now - flush_wait_start_us;
+            flush_wait_start_us = 0;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void slider_sweep_timer_cb(lv_timer_t *timer)
+{
+    static int32_t step = 2;
+    (void)timer;
+
+    int32_t value = lv_slider_get_value(scene_slider) + step;
+    if (value >= 100 || value <= 0) {
+        step = -step;
+    }
+    lv_slider_set_value(scene_slider, value, LV_ANIM_OFF);
+}
+
+static void full_redraw_timer_cb(lv_timer_t *timer)
+{
+    (void)timer;
+    lv_obj_invalidate(lv_screen_active());
+}
+
+static const char *scene_name(scene_t scene)
+{
+    switch (scene) {
+    case SCENE_IDLE:         return "idle";
+    case SCENE_SLIDER_SWEEP: return "slider sweep";
+    case SCENE_FULL_REDRAW:  return "full redraw";
+    }
+    return "?";
+}
+
+// Same content for every scene so only the workload differs
+static lv_obj_t *scene_create_screen(void)
+{
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x003a57), LV_PART_MAIN);
+
+    lv_obj_t *title = lv_label_create(scr);
+    lv_label_set_text(title, "Render scene");
+    lv_obj_set_style_text_color(title, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 20);
+
+    scene_slider = lv_slider_create(scr);
+    lv_obj_set_width(scene_slider, 200);
+    lv_obj_align(scene_slider, LV_ALIGN_CENTER, 0, 0);
+    lv_slider_set_range(scene_slider, 0, 100);
+    lv_slider_set_value(scene_slider, 50, LV_ANIM_OFF);
+
+    return scr;
+}
+
+static void scene_run(lv_obj_t *prev_scr, scene_t scene)
+{
+    lvgl_port_lock(0);
+    lv_obj_t *scr = scene_create_screen();
+    lv_screen_load(scr);
+    lvgl_port_unlock();
+
+    // Let the screen change settle before measuring
+    vTaskDelay(pdMS_TO_TICKS(3 * LV_DEF_REFR_PERIOD));
+
+    lvgl_port_lock(0);
+    lv_timer_t *timer = NULL;
+    if (scene == SCENE_SLIDER_SWEEP) {
+        timer = lv_timer_create(slider_sweep_timer_cb, SCENE_TIMER_MS, NULL);
+    } else if (scene == SCENE_FULL_REDRAW) {
+        timer = lv_timer_create(full_redraw_timer_cb, SCENE_TIMER_MS, NULL);
+    }
+    stats = (scene_stats_t){0};
+    render_start_us = 0;
+    flush_wait_start_us = 0;
+    lvgl_port_unlock();
+
+    vTaskDelay(pdMS_TO_TICKS(SCENE_DURATION_MS));
+
+    lvgl_port_lock(0);
+    scene_stats_t result = stats;
+    if (timer) {
+        lv_timer_delete(timer);
+    }
+    lv_screen_load(prev_scr);
+    lv_obj_delete(scr);
+    lvgl_port_unlock();
+
+    float seconds = SCENE_DURATION_MS / 1000.0f;
+    float render_ms = result.frames ? (result.render_us - result.flush_wait_us) / 1000.0f / result.frames : 0.0f;
+    float flush_ms = result.frames ? result.flush_wait_us / 1000.0f / result.frames : 0.0f;
+
+    ESP_LOGI(TAG, "%s: %lu frames in %d s (%.1f FPS), render %.2f ms/frame, flush wait %.2f ms/frame, max frame %.2f ms",
+             scene_name(scene), (unsigned long)result.frames, CONFIG_TEMPLATE_RENDER_SCENE_SECONDS,
+             result.frames / seconds, render_ms, flush_ms, result.max_frame_us / 1000.0f);
+}
+
+void render_scenes_run(lv_display_t *disp)
+{
+    static const scene_t scenes[] = {
+#if CONFIG_TEMPLATE_RENDER_SCENES_ALL || CONFIG_TEMPLATE_RENDER_SCENES_IDLE
+        SCENE_IDLE,
+#endif
+#if CONFIG_TEMPLATE_RENDER_SCENES_ALL || CONFIG_TEMPLATE_RENDER_SCENES_SLIDER_SWEEP
+        SCENE_SLIDER_SWEEP,
+#endif
+#if CONFIG_TEMPLATE_RENDER_SCENES_ALL || CONFIG_TEMPLATE_RENDER_SCENES_FULL_REDRAW
+        SCENE_FULL_REDRAW,
+#endif
+    };
+
+    ESP_LOGI(TAG, "Running %d render scene(s), %d s each",
+             (int)(sizeof(scenes) / sizeof(scenes[0])), CONFIG_TEMPLATE_RENDER_SCENE_SECONDS);
+
+    lvgl_port_lock(0);
+    lv_obj_t *prev_scr = lv_display_get_screen_active(disp);
+    lv_display_add_event_cb(disp, render_event_cb, LV_EVENT_ALL, NULL);
+    lvgl_port_unlock();
+
+    for (size_t i = 0; i < sizeof(scenes) / sizeof(scenes[0]); i++) {
+        scene_run(prev_scr, scenes[i]);
+    }
+
+    lvgl_port_lock(0);
+    lv_display_remove_event_cb_with_user_data(disp, render_event_cb, NULL);
+    lvgl_port_unlock();
+
+    ESP_LOGI(TAG, "Render scenes complete");
+}
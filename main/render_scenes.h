@@ -0,0 +1,37 @@
+/**
+ * @file render_scenes.h
+ * @brief Repeatable render scenes for ESP32-S3 LVGL Template
+ *
+ * Runs fixed-duration scenes driven by LVGL timers (idle, slider sweep and
+ * full-screen redraw) and logs frame rate, render time and flush wait time
+ * for each, so the size and performance build profiles can be compared on
+ * the same workload. LVGL's system monitor also logs its own per-second
+ * render/flush figures while the scenes run.
+ *
+ * Enabled with the "Run render scenes at startup" choice in menuconfig.
+ */
+
+#ifndef RENDER_SCENES_H
+#define RENDER_SCENES_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Run the selected scenes, then return to the previous screen
+ *
+ * Blocks for CONFIG_TEMPLATE_RENDER_SCENE_SECONDS per scene. Must be called
+ * without the LVGL lock held.
+ *
+ * @param disp Display to run the scenes on
+ */
+void render_scenes_run(lv_display_t *disp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RENDER_SCENES_H